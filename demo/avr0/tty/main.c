@@ -50,7 +50,8 @@ int main(void)
         {
             temp2 = '~';
         }
-        printf("%c%c", (temp1++), (temp2--));
+        putchar(temp1++);
+        putchar(temp2--);
         _delay_ms(1000);
 
         if(!(PORTA.IN & PIN2_bm))